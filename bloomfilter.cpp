@@ -0,0 +1,69 @@
+// bloomfilter.cpp
+// Implementation file for the BloomFilter class.
+// Provides the hashing and counter logic used to reject words that are not in the dictionary.
+
+// Include necessary header files
+#include "bloomfilter.h"     // Header for BloomFilter class
+#include <cstdint>           // For std::uintptr_t
+
+// BloomFilter constructor
+BloomFilter::BloomFilter(unsigned int words) : counters(nullptr), blocks(0), words(0) {
+    resize(words);
+}
+
+// Empty the filter and size it for a number of words, rounding up to whole blocks
+void BloomFilter::resize(unsigned int words) {
+    this->words = words > MIN_WORDS ? words : MIN_WORDS;
+    blocks = static_cast<unsigned int>(static_cast<unsigned long long>(this->words) * COUNTERS_PER_WORD / BLOCK_SIZE + 1);
+    storage.assign(static_cast<size_t>(blocks) * BLOCK_SIZE + BLOCK_SIZE - 1, 0); // All counters start at zero
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(storage.data());
+    counters = storage.data() + (BLOCK_SIZE - address % BLOCK_SIZE) % BLOCK_SIZE; // Start blocks on a cache line
+}
+
+// Get the number of words the filter is sized for
+unsigned int BloomFilter::getWords() const {
+    return words;
+}
+
+// Generate the 64-bit FNV-1a hash of a word (independent of the table's own hash)
+unsigned long long BloomFilter::hashWord(const std::string& word) {
+    unsigned long long hash = 14695981039346656037ULL; // FNV offset basis
+    for (const auto& ch : word) {
+        hash ^= static_cast<unsigned char>(ch);
+        hash *= 1099511628211ULL; // FNV prime
+    }
+    return hash;
+}
+
+// Add a word to the filter
+void BloomFilter::add(const std::string& word) {
+    unsigned long long hash = hashWord(word);
+    unsigned char* block = &counters[(hash % blocks) * BLOCK_SIZE]; // Block chosen by the whole hash
+    hash >>= 32; // Upper bits pick counters within the block
+    for (unsigned int i = 0; i < PROBES; ++i) {
+        unsigned char& counter = block[(hash >> (i * 6)) % BLOCK_SIZE];
+        if (counter < 255) ++counter; // Saturated counters stay put until the next rebuild
+    }
+}
+
+// Remove a word from the filter
+void BloomFilter::remove(const std::string& word) {
+    unsigned long long hash = hashWord(word);
+    unsigned char* block = &counters[(hash % blocks) * BLOCK_SIZE];
+    hash >>= 32;
+    for (unsigned int i = 0; i < PROBES; ++i) {
+        unsigned char& counter = block[(hash >> (i * 6)) % BLOCK_SIZE];
+        if (counter > 0 && counter < 255) --counter; // A saturated counter no longer knows its true count
+    }
+}
+
+// Check whether a word may be in the filter
+bool BloomFilter::mayContain(const std::string& word) const {
+    unsigned long long hash = hashWord(word);
+    const unsigned char* block = &counters[(hash % blocks) * BLOCK_SIZE];
+    hash >>= 32;
+    for (unsigned int i = 0; i < PROBES; ++i) {
+        if (block[(hash >> (i * 6)) % BLOCK_SIZE] == 0) return false; // Any empty counter means absent
+    }
+    return true;
+}
@@ -0,0 +1,53 @@
+// bloomfilter.h
+// Header file for the BloomFilter class, a probabilistic membership test placed in front of the hash table.
+// Provides declarations for the BloomFilter class and its associated methods.
+
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+#include <string>    // For std::string
+#include <vector>    // For std::vector
+
+// BloomFilter class: Blocked counting Bloom filter over lowercase words.
+// Every word maps to a single 64-byte block, aligned to a cache line, and sets several counters inside it,
+// so a lookup touches one cache line. Counters instead of bits allow words to be removed again.
+class BloomFilter {
+private:
+    std::vector<unsigned char> storage;     // Counter memory, with slack to align the first block.
+    unsigned char* counters;                // Counter array inside storage, 64-byte aligned and split into blocks.
+    unsigned int blocks;                    // Number of blocks in the counter array.
+    unsigned int words;                     // Number of words the filter is sized for.
+
+    // Computes the 64-bit hash used to pick a block and the counters within it.
+    static unsigned long long hashWord(const std::string& word);
+
+public:
+    static const unsigned int BLOCK_SIZE = 64;  // Counters per block (one cache line).
+    static const unsigned int PROBES = 4;       // Counters set per word.
+    static const unsigned int COUNTERS_PER_WORD = 8;    // Counters reserved per word (~2% false positives).
+    static const unsigned int MIN_WORDS = 1024;         // Smallest number of words a filter is sized for.
+
+    // Constructor: Creates an empty filter sized for the given number of words.
+    explicit BloomFilter(unsigned int words);
+
+    // Not copyable: counters points into storage.
+    BloomFilter(const BloomFilter&) = delete;
+    BloomFilter& operator=(const BloomFilter&) = delete;
+
+    // Empties the filter and resizes it for the given number of words.
+    void resize(unsigned int words);
+
+    // Returns the number of words the filter is sized for.
+    unsigned int getWords() const;
+
+    // Records a word in the filter.
+    void add(const std::string& word);
+
+    // Removes a previously added word from the filter.
+    void remove(const std::string& word);
+
+    // Returns false if the word is definitely absent, true if it may be present.
+    bool mayContain(const std::string& word) const;
+};
+
+#endif // BLOOMFILTER_H
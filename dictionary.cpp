@@ -35,83 +35,100 @@ std::string getCurrentWorkingDirectory() {
     }
 }
 
+// PooledString constructor
+PooledString::PooledString(const std::string* text) : text(text) {}
+
+// Get the pooled text
+const std::string& PooledString::get() const {
+    return *text;
+}
+
+// Look up or add a string in the pool
+PooledString StringPool::intern(const std::string& value) {
+    return PooledString(&*strings.insert(value).first);
+}
+
 // Translation class constructor
-Translation::Translation(const std::string& meanings, const std::string& language) : language(language) {
+Translation::Translation(const std::string& meanings, const std::string& language, StringPool& pool)
+    : language(pool.intern(language)) {
     if (meanings.empty()) return;  // Skip if no meanings provided
     std::stringstream ss(meanings);  // Create string stream from meanings
     std::string meaning;  // Temporary storage for each meaning
     // Split meanings by semicolon and add to vector
     while (std::getline(ss, meaning, ';')) {
         if (!meaning.empty()) {  // Skip empty meanings
-            this->meanings.push_back(meaning);
+            this->meanings.push_back(pool.intern(meaning));
         }
     }
     // Ensure at least one meaning exists
     if (this->meanings.empty()) {
-        this->meanings.push_back("");
+        this->meanings.push_back(pool.intern(""));
     }
+    this->meanings.shrink_to_fit();  // Drop growth slack, most words never get more meanings
 }
 
 // Add a new meaning to the translation
-void Translation::addMeaning(const std::string& newMeaning) {
+void Translation::addMeaning(const std::string& newMeaning, StringPool& pool) {
     if (newMeaning.empty()) return;  // Skip empty meanings
     // Check if meaning already exists (case-insensitive)
     for (const auto& existing : meanings) {
-        if (toLower(existing) == toLower(newMeaning)) return;
+        if (toLower(existing.get()) == toLower(newMeaning)) return;
     }
-    meanings.push_back(newMeaning);  // Add new meaning
+    meanings.push_back(pool.intern(newMeaning));  // Add new meaning
 }
 
 // Display the translation information
 void Translation::display() const {
-    std::cout << language << " : ";  // Print language
+    std::cout << language.get() << " : ";  // Print language
     // Print all meanings separated by semicolons
     for (size_t i = 0; i < meanings.size(); ++i) {
-        std::cout << meanings[i] << (i < meanings.size() - 1 ? "; " : "");
+        std::cout << meanings[i].get() << (i < meanings.size() - 1 ? "; " : "");
     }
     std::cout << std::endl;  // End line
 }
 
 // Get the language of the translation
 const std::string& Translation::getLanguage() const {
-    return language;
+    return language.get();
 }
 
 // Get the meanings (non-const version)
-std::vector<std::string>& Translation::getMeanings() {
+std::vector<PooledString>& Translation::getMeanings() {
     return meanings;
 }
 
 // Get the meanings (const version)
-const std::vector<std::string>& Translation::getMeanings() const {
+const std::vector<PooledString>& Translation::getMeanings() const {
     return meanings;
 }
 
 // Entry class constructor
-Entry::Entry(const std::string& word, const std::string& meanings, const std::string& language, const std::string& originalLine)
-    : word(toLower(word)), originalWord(word), originalLine(originalLine), deleted(false) {
+Entry::Entry(const std::string& word, const std::string& meanings, const std::string& language, StringPool& pool)
+    : word(toLower(word)), deleted(false) {
     // Handle empty word case
     if (word.empty()) {
         this->word = "unknown";
-        this->originalWord = "unknown";
-        this->originalLine = "unknown:" + meanings;
+    }
+    // Keep the original case only when it differs from the lowercase word
+    if (word != this->word && !word.empty()) {
+        originalWord.reset(new std::string(word));
     }
     // Add initial translation
-    translations.push_back(Translation(meanings, language));
+    translations.push_back(Translation(meanings, language, pool));
 }
 
 // Add a new translation to the entry
-void Entry::addTranslation(const std::string& newMeanings, const std::string& language) {
+void Entry::addTranslation(const std::string& newMeanings, const std::string& language, StringPool& pool) {
     if (language.empty() || newMeanings.empty()) return;  // Validate input
     // Check if translation for this language already exists
     for (auto& trans : translations) {
         if (toLower(trans.getLanguage()) == toLower(language)) {
-            trans.addMeaning(newMeanings);  // Add meaning to existing translation
+            trans.addMeaning(newMeanings, pool);  // Add meaning to existing translation
             return;
         }
     }
     // Create new translation if language doesn't exist
-    translations.emplace_back(newMeanings, language);
+    translations.emplace_back(newMeanings, language, pool);
 }
 
 // Print entry information
@@ -131,12 +148,7 @@ const std::string& Entry::getWord() const {
 
 // Get original case version of word
 const std::string& Entry::getOriginalWord() const {
-    return originalWord;
-}
-
-// Get original line from input file
-const std::string& Entry::getOriginalLine() const {
-    return originalLine;
+    return originalWord ? *originalWord : word;
 }
 
 // Check if entry is marked as deleted
@@ -9,6 +9,8 @@
 #include <string>    // For std::string
 #include <vector>    // For std::vector
 #include <sstream>   // For std::stringstream
+#include <memory>    // For std::unique_ptr
+#include <unordered_set> // For std::unordered_set
 
 // Function declaration: Converts a string to lowercase for case-insensitive operations
 std::string toLower(const std::string& str);
@@ -16,17 +18,41 @@ std::string toLower(const std::string& str);
 // Function declaration: Gets the current working directory for file operations
 std::string getCurrentWorkingDirectory();
 
+// PooledString class: Handle to a string stored once in a StringPool.
+// Cheap to copy; stays valid as long as the pool that produced it.
+class PooledString {
+private:
+    const std::string* text;            // Text owned by the pool
+public:
+    // Constructor: Wraps a string owned by a pool
+    explicit PooledString(const std::string* text);
+    
+    // Returns the pooled text
+    const std::string& get() const;
+};
+
+// StringPool class: Stores each distinct meaning or language name once for the entries of one table.
+// A pool belongs to a single table and is only used by the thread working on that table, so it takes no locks.
+// Strings stay until the pool is destroyed; a reload starts the table over with a fresh pool.
+class StringPool {
+private:
+    std::unordered_set<std::string> strings;  // Distinct texts (node addresses stay put across rehashing)
+public:
+    // Returns a handle to the pooled copy of a string, adding it if needed
+    PooledString intern(const std::string& value);
+};
+
 // Translation class: Represents translations for a word in a specific language
 class Translation {
 private:
-    std::string language;               // Stores the language of the translation
-    std::vector<std::string> meanings;  // Stores all meanings/translations for this language
+    PooledString language;              // Stores the language of the translation
+    std::vector<PooledString> meanings; // Stores all meanings/translations for this language
 public:
-    // Constructor: Creates a new Translation with given meanings and language
-    Translation(const std::string& meanings, const std::string& language);
+    // Constructor: Creates a new Translation with given meanings and language, stored in the pool
+    Translation(const std::string& meanings, const std::string& language, StringPool& pool);
     
     // Adds a new meaning to this translation if it doesn't already exist
-    void addMeaning(const std::string& newMeaning);
+    void addMeaning(const std::string& newMeaning, StringPool& pool);
     
     // Displays the translation in a readable format
     void display() const;
@@ -35,26 +61,25 @@ public:
     const std::string& getLanguage() const;
     
     // Returns the meanings vector (non-const version)
-    std::vector<std::string>& getMeanings();
+    std::vector<PooledString>& getMeanings();
     
     // Returns the meanings vector (const version)
-    const std::vector<std::string>& getMeanings() const;
+    const std::vector<PooledString>& getMeanings() const;
 };
 
 // Entry class: Represents a word with its translations in multiple languages
 class Entry {
 private:
     std::string word;                   // Lowercase version of the word for case-insensitive comparison
-    std::string originalWord;           // Original case version of the word
-    std::string originalLine;           // Original line from input file
+    std::unique_ptr<std::string> originalWord;  // Original case version of the word, nullptr when it equals word
     std::vector<Translation> translations;  // All translations for this word
     bool deleted;                       // Flag to mark deleted entries
 public:
     // Constructor: Creates a new dictionary entry
-    Entry(const std::string& word, const std::string& meanings, const std::string& language, const std::string& originalLine = "");
+    Entry(const std::string& word, const std::string& meanings, const std::string& language, StringPool& pool);
     
     // Adds a new translation or meaning to an existing translation
-    void addTranslation(const std::string& newMeanings, const std::string& language);
+    void addTranslation(const std::string& newMeanings, const std::string& language, StringPool& pool);
     
     // Prints the entry information including comparison count
     void print(int comparisons, const std::string& displayWord) const;
@@ -65,9 +90,6 @@ public:
     // Returns the original case version of the word
     const std::string& getOriginalWord() const;
     
-    // Returns the original line from input file
-    const std::string& getOriginalLine() const;
-    
     // Checks if this entry is marked as deleted
     bool isDeleted() const;
     
@@ -7,10 +7,12 @@
 #include "dictionary.h"      // Header for Dictionary functionality
 #include <iostream>          // For std::cout and std::cerr
 #include <fstream>           // For file operations (std::ofstream, std::ifstream)
-#include <algorithm>         // For std::sort (though not directly used in this file)
+#include <algorithm>         // For std::sort and std::lower_bound
+#include <map>               // For sorted per-language results
+#include <thread>            // For std::thread in parallel scans
 
 // HashTable constructor with initial capacity
-HashTable::HashTable(unsigned int capacity) : size(0), capacity(capacity), collisions(0) {
+HashTable::HashTable(unsigned int capacity, bool useFilter) : size(0), capacity(capacity), collisions(0), filter(nullptr), bulkLoading(false) {
     // Validate capacity
     if (capacity <= 0) {
         capacity = 1171891; // Default capacity for large datasets
@@ -25,6 +27,9 @@ HashTable::HashTable(unsigned int capacity) : size(0), capacity(capacity), colli
     for (unsigned int i = 0; i < static_cast<unsigned int>(capacity); ++i) {
         buckets[i] = nullptr;
     }
+    if (useFilter) {
+        filter = new BloomFilter(0); // Sized from the entries by rebuildFilter()
+    }
 }
 
 // HashTable destructor
@@ -34,6 +39,7 @@ HashTable::~HashTable() {
         delete buckets[i];
     }
     delete[] buckets; // Delete the bucket array itself
+    delete filter; // Delete the membership filter
 }
 
 // Get current size of hash table
@@ -46,6 +52,61 @@ unsigned int HashTable::getCollisions() const {
     return collisions;
 }
 
+// Get number of buckets in the table
+unsigned int HashTable::getCapacity() const {
+    return capacity;
+}
+
+// Check whether lookups use the membership filter
+bool HashTable::hasFilter() const {
+    return filter != nullptr;
+}
+
+// Resize the membership filter for the current entries and refill it
+void HashTable::rebuildFilter() {
+    if (!filter) return;
+    filter->resize(size + size / 4); // Room for 25% growth; also resets counters that saturated
+    for (unsigned int i = 0; i < capacity; ++i) {
+        if (buckets[i] != nullptr && !buckets[i]->isDeleted()) {
+            filter->add(buckets[i]->getWord());
+        }
+    }
+}
+
+// End a bulk load by bringing the posting lists and the filter up to date
+void HashTable::finishBulkLoad() {
+    bulkLoading = false;
+    for (auto& postings : languageIndex) {
+        std::sort(postings.second.begin(), postings.second.end()); // Appended unsorted during the load
+        postings.second.shrink_to_fit();
+    }
+    rebuildFilter();
+}
+
+// Add a bucket to a language's posting list
+void HashTable::indexLanguage(const std::string& language, unsigned int idx) {
+    std::vector<unsigned int>& postings = languageIndex[toLower(language)];
+    if (bulkLoading) {
+        postings.push_back(idx); // Sorted once by finishBulkLoad()
+        return;
+    }
+    postings.insert(std::lower_bound(postings.begin(), postings.end(), idx), idx);
+}
+
+// Remove a bucket from a language's posting list
+void HashTable::unindexLanguage(const std::string& language, unsigned int idx) {
+    auto postings = languageIndex.find(toLower(language));
+    if (postings == languageIndex.end()) return;
+    std::vector<unsigned int>& list = postings->second;
+    auto it = std::lower_bound(list.begin(), list.end(), idx); // Lists are sorted, no scan needed
+    if (it != list.end() && *it == idx) {
+        list.erase(it);
+    }
+    if (list.empty()) {
+        languageIndex.erase(postings); // Language no longer in the dictionary
+    }
+}
+
 // Generate hash code for a given word
 unsigned long HashTable::hashCode(const std::string& word) const {
     unsigned long hash = 0; // Initialize hash value
@@ -62,7 +123,7 @@ unsigned long HashTable::hashCode(const std::string& word) const {
 
 // Insert a new word into the hash table
 void HashTable::insert(const std::string& word, const std::string& meanings, const std::string& language,
-                      const std::string& originalLine, bool silent) {
+                      bool silent) {
     // Validate input parameters
     if (word.empty() || meanings.empty() || language.empty()) {
         if (!silent) {
@@ -93,16 +154,28 @@ void HashTable::insert(const std::string& word, const std::string& meanings, con
     
     // Handle empty or deleted slot
     if (buckets[idx] == nullptr || buckets[idx]->isDeleted()) {
-        buckets[idx] = new Entry(word, meanings, language, originalLine);
+        buckets[idx] = new Entry(word, meanings, language, pool);
         if (!buckets[idx]) {
             if (!silent) {
                 std::cerr << "Memory allocation failed for new entry!" << std::endl;
             }
             return;
         }
+        indexLanguage(language, idx);
         ++size;
+        if (filter && !bulkLoading) { // Bulk loads rebuild the filter once at the end
+            if (size > filter->getWords()) {
+                rebuildFilter(); // Outgrown: resize for the larger table
+            } else {
+                filter->add(buckets[idx]->getWord()); // Record the new word in the filter
+            }
+        }
     } else {
-        buckets[idx]->addTranslation(meanings, language);
+        size_t languages = buckets[idx]->getTranslations().size();
+        buckets[idx]->addTranslation(meanings, language, pool);
+        if (buckets[idx]->getTranslations().size() > languages) { // A new language, not just a new meaning
+            indexLanguage(language, idx);
+        }
     }
 
 
@@ -119,6 +192,10 @@ void HashTable::find(const std::string& word) const {
         return;
     }
     std::string lowerWord = toLower(word); // Convert to lowercase
+    if (filter && !filter->mayContain(lowerWord)) { // Filter rules the word out without probing
+        std::cout << word << " not found in the Dictionary." << std::endl;
+        return;
+    }
     unsigned int idx = hashCode(lowerWord); // Calculate hash index
     unsigned int originalIdx = idx; // Store original index
     int comparisons = 0; // Track comparisons
@@ -151,6 +228,10 @@ void HashTable::delWord(const std::string& word) {
     while (buckets[idx] != nullptr) {
         if (toLower(buckets[idx]->getWord()) == lowerWord && !buckets[idx]->isDeleted()) {
             buckets[idx]->markDeleted(); // Mark as deleted
+            if (filter) filter->remove(lowerWord); // Forget the word in the filter
+            for (const auto& trans : buckets[idx]->getTranslations()) {
+                unindexLanguage(trans.getLanguage(), idx); // Drop the word from every posting list
+            }
             --size; // Decrement size counter
             std::cout << word << " has been successfully deleted from the Dictionary." << std::endl;
             return;
@@ -163,7 +244,7 @@ void HashTable::delWord(const std::string& word) {
 
 // Add a new word to the hash table (wrapper for insert)
 void HashTable::addWord(const std::string& word, const std::string& meanings, const std::string& language) {
-    insert(word, meanings, language, word + ":" + meanings, false);
+    insert(word, meanings, language, false);
 }
 
 // Delete a specific translation for a word
@@ -185,6 +266,7 @@ void HashTable::delTranslation(const std::string& word, const std::string& langu
             for (auto it = translations.begin(); it != translations.end(); ++it) {
                 if (toLower(it->getLanguage()) == lowerLanguage) {
                     translations.erase(it); // Delete translation
+                    unindexLanguage(lowerLanguage, idx);
                     std::cout << "Translation has been successfully deleted from the Dictionary." << std::endl;
                     return;
                 }
@@ -219,11 +301,12 @@ void HashTable::delMeaning(const std::string& word, const std::string& meaning,
                     auto& meanings = it->getMeanings(); // Get meanings
                     // Search for matching meaning
                     for (auto mit = meanings.begin(); mit != meanings.end(); ++mit) {
-                        if (toLower(*mit) == toLower(meaning)) {
+                        if (toLower(mit->get()) == toLower(meaning)) {
                             meanings.erase(mit); // Delete meaning
                             // If no meanings left, delete the translation
                             if (meanings.empty()) {
                                 translations.erase(it);
+                                unindexLanguage(lowerLanguage, idx);
                             }
                             std::cout << "Meaning has been successfully deleted from the Dictionary." << std::endl;
                             return;
@@ -256,18 +339,19 @@ void HashTable::exportData(const std::string& language, const std::string& fileP
     outFile << language << std::endl; // Write language header
     unsigned int count = 0; // Track number of exported records
     
-    // Iterate through all buckets
-    for (unsigned int i = 0; i < capacity; ++i) {
-        if (buckets[i] != nullptr && !buckets[i]->isDeleted()) {
+    auto postings = languageIndex.find(lowerLanguage);
+    if (postings != languageIndex.end()) {
+        // Visit only the entries translated into this language, in bucket order
+        for (unsigned int i : postings->second) {
             const std::vector<Translation>& translations = buckets[i]->getTranslations();
-            // Check all translations for matching language
+            // Find the translation for this language
             for (std::vector<Translation>::const_iterator it = translations.begin(); it != translations.end(); ++it) {
                 if (toLower(it->getLanguage()) == lowerLanguage) {
                     // Write word and meanings to file
                     outFile << buckets[i]->getOriginalWord() << ":";
-                    const std::vector<std::string>& meanings = it->getMeanings();
+                    const std::vector<PooledString>& meanings = it->getMeanings();
                     for (size_t k = 0; k < meanings.size(); ++k) {
-                        outFile << meanings[k] << (k < meanings.size() - 1 ? ";" : "");
+                        outFile << meanings[k].get() << (k < meanings.size() - 1 ? ";" : "");
                     }
                     outFile << std::endl;
                     count++;
@@ -279,31 +363,127 @@ void HashTable::exportData(const std::string& language, const std::string& fileP
     std::cout << count << " records have been successfully exported to " << filePath << std::endl;
 }
 
+// List all languages with their word counts
+void HashTable::listLanguages() const {
+    if (languageIndex.empty()) {
+        std::cout << "No languages in the Dictionary." << std::endl;
+        return;
+    }
+    std::map<std::string, size_t> sorted; // Sort languages by name
+    for (const auto& postings : languageIndex) {
+        sorted[postings.first] = postings.second.size();
+    }
+    for (const auto& language : sorted) {
+        std::cout << language.first << " : " << language.second << " words" << std::endl;
+    }
+}
+
+// Count words with exactly the given number of meanings, per language
+void HashTable::countMeanings(unsigned int meaningCount) const {
+    if (meaningCount == 0) { // Validate input
+        std::cout << "Invalid input: number of meanings must be at least 1." << std::endl;
+        return;
+    }
+    unsigned int threads = scanThreads();
+    // One tally per scanning thread, keyed by the pooled language name: equal names share one address,
+    // so the scan neither copies nor lowercases them
+    std::vector<std::unordered_map<const std::string*, unsigned int>> partial(threads);
+    parallelScan([&](unsigned int thread, const Entry& entry) {
+        for (const auto& trans : entry.getTranslations()) {
+            if (trans.getMeanings().size() == meaningCount) {
+                ++partial[thread][&trans.getLanguage()];
+            }
+        }
+    }, threads);
+    std::map<std::string, unsigned int> total; // Merge the per-thread tallies, lowercasing each distinct name once
+    for (const auto& tally : partial) {
+        for (const auto& language : tally) {
+            total[toLower(*language.first)] += language.second;
+        }
+    }
+    if (total.empty()) {
+        std::cout << "No words with " << meaningCount << " meaning(s) in the Dictionary." << std::endl;
+        return;
+    }
+    for (const auto& language : total) {
+        std::cout << language.first << " : " << language.second << " words with " << meaningCount << " meaning(s)" << std::endl;
+    }
+}
+
+// Visit all live entries, one contiguous bucket range per thread
+void HashTable::parallelScan(const std::function<void(unsigned int, const Entry&)>& visit, unsigned int threads) const {
+    if (threads == 0) threads = 1;
+    unsigned int chunk = capacity / threads + 1; // Buckets per thread
+    std::vector<std::thread> workers;
+    for (unsigned int t = 0; t < threads; ++t) {
+        unsigned int begin = std::min(capacity, t * chunk);
+        unsigned int end = std::min(capacity, begin + chunk);
+        workers.emplace_back([this, &visit, t, begin, end]() {
+            for (unsigned int i = begin; i < end; ++i) {
+                if (buckets[i] != nullptr && !buckets[i]->isDeleted()) {
+                    visit(t, *buckets[i]);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join(); // Wait for every range to be scanned
+    }
+}
+
+// Number of threads for whole-table scans (at least one)
+unsigned int HashTable::scanThreads() {
+    unsigned int threads = std::thread::hardware_concurrency();
+    return threads ? threads : 1;
+}
+
+// Copy entries from another table, skipping one language
+void HashTable::copyFrom(const HashTable& source, const std::string& skipLanguage) {
+    std::string lowerSkip = toLower(skipLanguage); // Convert to lowercase
+    bulkLoading = true;
+    for (unsigned int i = 0; i < source.capacity; ++i) {
+        const Entry* entry = source.buckets[i];
+        if (entry == nullptr || entry->isDeleted()) continue;
+        for (const auto& trans : entry->getTranslations()) {
+            if (toLower(trans.getLanguage()) == lowerSkip) continue; // Replaced by the caller
+            // Rejoin the meanings in input file format
+            std::string meanings;
+            const std::vector<PooledString>& list = trans.getMeanings();
+            for (size_t k = 0; k < list.size(); ++k) {
+                meanings += list[k].get() + (k < list.size() - 1 ? ";" : "");
+            }
+            insert(entry->getOriginalWord(), meanings, trans.getLanguage(), true); // Silent insert
+        }
+    }
+    finishBulkLoad();
+}
+
 // Import data from a file
-void HashTable::import(const std::string& path) {
+bool HashTable::import(const std::string& path, bool silent) {
     if (path.empty()) { // Validate input
         std::cout << "Invalid input: file path cannot be empty." << std::endl;
-        return;
+        return false;
     }
     std::ifstream inFile(path); // Open input file
     if (!inFile.is_open()) { // Check if file opened successfully
         std::cout << "Error opening file: " << path << std::endl;
         std::cout << "Current working directory: " << getCurrentWorkingDirectory() << std::endl;
         std::cout << "Please ensure the file exists in the current directory or provide the full path." << std::endl;
-        return;
+        return false;
     }
     std::string language, line;
     if (!std::getline(inFile, language)) { // Read language from first line
         std::cout << "File is empty or corrupted." << std::endl;
         inFile.close();
-        return;
+        return false;
     }
     if (language.empty()) { // Validate language
         std::cout << "Language not specified in file." << std::endl;
         inFile.close();
-        return;
+        return false;
     }
     unsigned int count = 0; // Track number of imported words
+    bulkLoading = true;
     
     // Read each line from the file
     while (std::getline(inFile, line)) {
@@ -323,10 +503,14 @@ void HashTable::import(const std::string& path) {
         
         // Insert valid words
         if (!word.empty()) {
-            insert(word, translation, language, line, true); // Silent insert
+            insert(word, translation, language, true); // Silent insert
             ++count;
         }
     }
     inFile.close(); // Close the file
-    std::cout << count << " " << language << " words have been imported successfully." << std::endl;
+    finishBulkLoad();
+    if (!silent) {
+        std::cout << count << " " << language << " words have been imported successfully." << std::endl;
+    }
+    return true;
 }
\ No newline at end of file
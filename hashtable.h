@@ -6,6 +6,9 @@
 #define HASHTABLE_H
 
 #include "dictionary.h"
+#include "bloomfilter.h"
+#include <functional>
+#include <unordered_map>
 
 // HashTable class: Manages dictionary entries using an open-addressing hash table with linear probing.
 class HashTable {
@@ -14,10 +17,26 @@ private:
     unsigned int size;              // Current number of non-deleted entries in the table.
     unsigned int capacity;          // Maximum number of buckets in the table.
     unsigned int collisions;        // Total number of collisions during insertion.
+    StringPool pool;                // Meanings and language names shared by this table's entries.
+    BloomFilter* filter;            // Membership filter that short-circuits misses (nullptr when disabled).
+    bool bulkLoading;               // Set while import or copyFrom fill the table; see finishBulkLoad().
+    std::unordered_map<std::string, std::vector<unsigned int>> languageIndex;  // Lowercase language -> sorted buckets of entries translated into it.
+
+    // Resizes the membership filter for the live entries and refills it.
+    void rebuildFilter();
+
+    // Ends a bulk load: sorts the posting lists and rebuilds the membership filter.
+    void finishBulkLoad();
+
+    // Records that the entry in a bucket has a translation in the given language.
+    void indexLanguage(const std::string& language, unsigned int idx);
+
+    // Removes a bucket from the given language's posting list.
+    void unindexLanguage(const std::string& language, unsigned int idx);
 
 public:
-    // Constructor: Initializes the hash table with a given capacity.
-    explicit HashTable(unsigned int capacity);
+    // Constructor: Initializes the hash table with a given capacity, optionally with a membership filter.
+    explicit HashTable(unsigned int capacity, bool useFilter = true);
 
     // Destructor: Cleans up dynamically allocated memory.
     ~HashTable();
@@ -28,12 +47,18 @@ public:
     // Getter for the total number of collisions.
     unsigned int getCollisions() const;
 
+    // Getter for the number of buckets in the table.
+    unsigned int getCapacity() const;
+
+    // Returns true if lookups go through a membership filter.
+    bool hasFilter() const;
+
     // Computes the hash code for a word using polynomial hashing.
     unsigned long hashCode(const std::string& word) const;
 
     // Inserts a new word or updates an existing word's translations.
     void insert(const std::string& word, const std::string& meanings, const std::string& language,
-                const std::string& originalLine = "", bool silent = false);
+                bool silent = false);
 
     // Searches for a word and prints its translations if found.
     void find(const std::string& word) const;
@@ -53,8 +78,24 @@ public:
     // Exports all entries for a given language to a file in alphabetical order.
     void exportData(const std::string& language, const std::string& filePath) const;
 
-    // Imports dictionary entries from a file.
-    void import(const std::string& path);
+    // Lists every language in the dictionary with its number of words.
+    void listLanguages() const;
+
+    // Counts, per language, the words that have exactly the given number of meanings.
+    void countMeanings(unsigned int meaningCount) const;
+
+    // Calls visit(thread, entry) for every live entry, splitting the buckets into contiguous ranges
+    // scanned by separate threads. Entries are read-only; results should be kept per thread.
+    void parallelScan(const std::function<void(unsigned int, const Entry&)>& visit, unsigned int threads) const;
+
+    // Number of threads used for whole-table scans.
+    static unsigned int scanThreads();
+
+    // Copies every live entry of another table, leaving out translations into the given language.
+    void copyFrom(const HashTable& source, const std::string& skipLanguage);
+
+    // Imports dictionary entries from a file. Returns false if the file could not be read.
+    bool import(const std::string& path, bool silent = false);
 };
 
 #endif // HASHTABLE_H
\ No newline at end of file
@@ -3,31 +3,101 @@
 #include <fstream>
 #include <iomanip>
 #include <algorithm>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 #include "hashtable.h"
 
 void help() {
     std::cout << "find <word>                         : Search a word and its meanings in the dictionary." << std::endl;
     std::cout << "import <path>                       : Import a dictionary file." << std::endl;
+    std::cout << "reload <path>                       : Re-import a dictionary file in the background, replacing its language's words." << std::endl;
     std::cout << "add <word:meaning(s):language>      : Add a word and/or its meanings (separated by ;) to the dictionary." << std::endl;
     std::cout << "delTranslation <word:language>      : Delete a specific translation of a word from the dictionary." << std::endl;
     std::cout << "delMeaning <word:meaning:language>  : Delete only a specific meaning of a word from the dictionary." << std::endl;
     std::cout << "delWord <word>                      : Delete a word and its all translations from the dictionary." << std::endl;
     std::cout << "export <language:filename>          : Export a given language dictionary to a file." << std::endl;
+    std::cout << "languages                           : List the languages in the dictionary with their word counts." << std::endl;
+    std::cout << "countMeanings <n>                   : Count the words with exactly n meanings in each language." << std::endl;
     std::cout << "exit                                : Exit the program" << std::endl;
 }
 
+// Tables released by their last user, waiting to be freed by the thread that retired them
+std::mutex retiredMutex;
+std::condition_variable retiredReady;
+std::vector<HashTable*> retiredTables;
+
+// Deleter for shared tables: hands the table over instead of freeing it on whichever thread let go last,
+// so a command that happens to drop the old table never pays for tearing it down
+void retireTable(HashTable* table) {
+    std::lock_guard<std::mutex> lock(retiredMutex);
+    retiredTables.push_back(table);
+    retiredReady.notify_all();
+}
+
+// Sleeps until the given table has been retired, then frees it on the calling thread
+void freeRetiredTable(HashTable* table) {
+    std::unique_lock<std::mutex> lock(retiredMutex);
+    retiredReady.wait(lock, [table]() {
+        return std::find(retiredTables.begin(), retiredTables.end(), table) != retiredTables.end();
+    });
+    retiredTables.erase(std::find(retiredTables.begin(), retiredTables.end(), table));
+    lock.unlock();
+    delete table;
+}
+
+// Builds a fresh table on the calling thread from the live one minus the file's language, imports the
+// file on top, then publishes it in place of the live table. Lines removed from the file are gone afterwards,
+// other languages are kept. Read-only commands keep running against the old table until the swap (the
+// command loop refuses changes meanwhile); the old table is freed here, off the command loop, once the
+// last command holding it has finished.
+void reload(std::shared_ptr<HashTable>& live, const std::string& path, std::atomic<bool>& reloading) {
+    std::string language; // Language named on the file's first line
+    std::ifstream inFile(path);
+    std::getline(inFile, language);
+    inFile.close();
+    std::shared_ptr<HashTable> fresh;
+    {
+        std::shared_ptr<HashTable> current = std::atomic_load(&live); // Released before the swap below
+        fresh = std::shared_ptr<HashTable>(new HashTable(current->getCapacity(), current->hasFilter()), retireTable);
+        if (!language.empty()) {
+            fresh->copyFrom(*current, language); // Keep everything the file does not replace
+        }
+    }
+    if (!fresh->import(path, true)) {
+        std::cout << "Reload of " << path << " aborted, keeping the current dictionary." << std::endl;
+        HashTable* unused = fresh.get();
+        fresh.reset();
+        freeRetiredTable(unused);
+        reloading = false;
+        return;
+    }
+    std::cout << "Reload of " << path << " complete: " << fresh->getSize() << " words." << std::endl;
+    std::shared_ptr<HashTable> old = std::atomic_exchange(&live, fresh); // Publish the new table
+    HashTable* oldTable = old.get();
+    old.reset(); // The last command still using the old table retires it
+    fresh.reset(); // From here on the command loop owns the new table
+    reloading = false; // Edits may go to the new table now
+    freeRetiredTable(oldTable); // Sleeps until the old table is retired
+}
+
 int main(int argc, char** args) {
-    HashTable myHashTable(1171891); // Initialize hash table with default capacity.
-    myHashTable.import("en-de.txt"); // Import the dictionary file
+    // Initialize hash table with default capacity. Shared so that a reload can swap it out.
+    std::shared_ptr<HashTable> myHashTable(new HashTable(1171891), retireTable);
+    myHashTable->import("en-de.txt"); // Import the dictionary file
     std::cout << "===================================================" << std::endl;
-    std::cout << "Size of HashTable                = " << myHashTable.getSize() << std::endl;
-    std::cout << "Total Number of Collisions       = " << myHashTable.getCollisions() << std::endl;
+    std::cout << "Size of HashTable                = " << myHashTable->getSize() << std::endl;
+    std::cout << "Total Number of Collisions       = " << myHashTable->getCollisions() << std::endl;
     std::cout << "Avg. Number of Collisions/Entry  = " << std::fixed << std::setprecision(2)
-        << (myHashTable.getSize() ? static_cast<float>(myHashTable.getCollisions()) / myHashTable.getSize() : 0) << std::endl;
+        << (myHashTable->getSize() ? static_cast<float>(myHashTable->getCollisions()) / myHashTable->getSize() : 0) << std::endl;
     std::cout << "===================================================" << std::endl;
 
     help();
 
+    std::thread reloader;                 // Background thread running the latest reload
+    std::atomic<bool> reloading(false);   // Set while a reload is in progress
     std::string user_input, command, argument1, argument2, argument3;
     while (true) {
         user_input = command = argument1 = argument2 = argument3 = ""; // Clear old values
@@ -46,40 +116,75 @@ int main(int argc, char** args) {
 
         if (command.empty()) continue;
         std::transform(command.begin(), command.end(), command.begin(), ::tolower);
+        std::shared_ptr<HashTable> current = std::atomic_load(&myHashTable); // Table this command runs against
+        // A reload is copying the live table; changes made now would be lost in the swap
+        if (reloading && (command == "import" || command == "add" || command == "delword" ||
+                          command == "deltranslation" || command == "delmeaning")) {
+            std::cout << "A reload is in progress, try again once it completes." << std::endl;
+            continue;
+        }
 
         if (command == "find") {
             std::getline(sstr, argument1);
-            myHashTable.find(argument1);
+            current->find(argument1);
         }
         else if (command == "import") {
             std::getline(sstr, argument1);
-            myHashTable.import(argument1);
+            current->import(argument1);
+        }
+        else if (command == "reload") {
+            std::getline(sstr, argument1);
+            if (argument1.empty()) {
+                std::cout << "Invalid input: file path cannot be empty." << std::endl;
+            }
+            else if (reloading) {
+                std::cout << "A reload is already in progress." << std::endl;
+            }
+            else {
+                if (reloader.joinable()) reloader.join(); // Reap the previous, finished reload
+                reloading = true;
+                reloader = std::thread(reload, std::ref(myHashTable), argument1, std::ref(reloading));
+                std::cout << "Reloading " << argument1 << " in the background..." << std::endl;
+            }
         }
         else if (command == "add") {
             std::getline(sstr, argument1, ':');
             std::getline(sstr, argument2, ':');
             std::getline(sstr, argument3);
-            myHashTable.addWord(argument1, argument2, argument3);
+            current->addWord(argument1, argument2, argument3);
         }
         else if (command == "delword") {
             std::getline(sstr, argument1);
-            myHashTable.delWord(argument1);
+            current->delWord(argument1);
         }
         else if (command == "deltranslation") {
             std::getline(sstr, argument1, ':');
             std::getline(sstr, argument2);
-            myHashTable.delTranslation(argument1, argument2);
+            current->delTranslation(argument1, argument2);
         }
         else if (command == "delmeaning") {
             std::getline(sstr, argument1, ':');
             std::getline(sstr, argument2, ':');
             std::getline(sstr, argument3);
-            myHashTable.delMeaning(argument1, argument2, argument3);
+            current->delMeaning(argument1, argument2, argument3);
         }
         else if (command == "export") {
             std::getline(sstr, argument1, ':');
             std::getline(sstr, argument2);
-            myHashTable.exportData(argument1, argument2);
+            current->exportData(argument1, argument2);
+        }
+        else if (command == "languages") {
+            current->listLanguages();
+        }
+        else if (command == "countmeanings") {
+            std::getline(sstr, argument1);
+            std::stringstream countStream(argument1);
+            int meaningCount = 0;
+            // Anything but a whole positive number (including negatives and trailing text) becomes 0, which is rejected
+            if (!(countStream >> meaningCount) || !(countStream >> std::ws).eof() || meaningCount <= 0) {
+                meaningCount = 0;
+            }
+            current->countMeanings(static_cast<unsigned int>(meaningCount));
         }
         else if (command == "exit") {
             break;
@@ -89,5 +194,9 @@ int main(int argc, char** args) {
         }
         std::cout << std::flush;
     }
+    if (reloader.joinable()) reloader.join(); // Let a pending reload finish before tearing down
+    HashTable* lastTable = myHashTable.get();
+    myHashTable.reset();
+    freeRetiredTable(lastTable); // Free the live table
     return 0;
 }